@@ -55,6 +55,21 @@ probes = [
 # List of cpu, where the harware performance counters will be enabled
 #cpuSet = [8]
 
+# Record a sample of transactions, to bound the overhead of probes on hot paths
+# every - record one in every N transactions, rate - max transactions recorded per second, per thread
+#sampling = {'every' : 10, 'rate' : 1000}
+
+# Record samples of probes without data in 8 bytes (probe id and truncated tsc), halving the volume of samples
+# Compact samples are not recorded, while pmu events or sampling is enabled
+#compactSamples = True
+
+# Keep samples of transactions slower than a threshold (in nano seconds), dropping the rest in the target process
+#tailThreshold = 50000
+
+# Pace collection of samples - the adaptive policy polls sooner, while pools of threads fill up to the watermark
+# policy - 'fixed' or 'adaptive', watermark - buffers filled in a pool, wakeup - wake up the collector at the watermark
+#polling = {'policy' : 'adaptive', 'watermark' : 8, 'wakeup' : True}
+
 
 ############################################# Benchmark transactions ############################################
 # List of stored reports from previous runs, to be used for benchmarking
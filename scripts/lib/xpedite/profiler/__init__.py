@@ -62,6 +62,8 @@ class Profiler(object):
 
     runtime = Runtime(
       app=app, probes=profileInfo.probes, pmc=profileInfo.pmc, cpuSet=profileInfo.cpuSet, pollInterval=1,
+      sampling=getattr(profileInfo, 'sampling', None), compactSamples=getattr(profileInfo, 'compactSamples', False),
+      tailThreshold=getattr(profileInfo, 'tailThreshold', None), polling=getattr(profileInfo, 'polling', None)
     )
     if not dryRun:
       begin = time.time()
@@ -67,17 +67,27 @@ class XpediteApp(object):
       return self.sampleFilePath
     return '/dev/shm/xpedite-*-{}-[0-9]*.data'.format(self.env.pid)
 
-  def beginProfile(self, pollInterval, timeout=10):
+  def beginProfile(self, pollInterval, polling=None, timeout=10):
     """
     Sends command to begin sample collection in the target application
 
     :param pollInterval: Heartbeat interval (seconds)
+    :param polling: map with optional keys 'policy' ('fixed' or 'adaptive'), 'watermark' and 'wakeup',
+                    to pace sample collection (Default value = None)
     :param timeout: Maximum time to await a response from app (Default value = 10 seconds)
 
     """
     self.runId = int(time.time())
     self.sampleFilePath = '/dev/shm/xpedite-{}-{}-*.data'.format(self.name, self.runId)
-    self.env.client.send('beginProfile {} {}'.format(self.sampleFilePath, pollInterval))
+    cmd = 'beginProfile {} {}'.format(self.sampleFilePath, pollInterval)
+    if polling:
+      if polling.get('policy'):
+        cmd += ' --pollPolicy {}'.format(polling['policy'])
+      if polling.get('watermark'):
+        cmd += ' --watermark {}'.format(int(polling['watermark']))
+      if polling.get('wakeup'):
+        cmd += ' --wakeup'
+    self.env.client.send(cmd)
     rc = self.env.client.readFrame(timeout)
     if rc:
       errmsg = 'failed to begin profiling - {}'.format(rc)
@@ -189,11 +199,12 @@ class XpediteDormantApp(XpediteApp):
     XpediteApp.__init__(self, name, ip, appInfoPath, dryRun=True)
     self.runId = runId
 
-  def beginProfile(self, pollInterval, timeout=10):
+  def beginProfile(self, pollInterval, polling=None, timeout=10):
     """
     Override for simulation of begin profile
 
     :param pollInterval: Heartbeat interval (seconds)
+    :param polling: map to pace sample collection (Default value = None)
     :param timeout: Maximum time to await a response from app (Default value = 10 seconds)
 
     """
@@ -5,6 +5,9 @@ This module provide functionality to
   1. Query the list of instrumented probes and their current status
   2. Activate/Deactivate a probe
   3. Configure collection of performance counter
+  4. Configure sampling of transactions
+  5. Configure compact samples
+  6. Configure tail filter, to keep samples of slow transactions only
 
 Author: Manikandan Dhamodharan, Morgan Stanley
 """
@@ -38,21 +41,21 @@ class ProbeAdmin(object):
       raise Exception('failed to query probes - have you instrumentd any xpedite probes in your binary ?')
 
   @staticmethod
-  def _updateProbe(app, anchoredProbe, targetState):
+  def _updateProbes(app, anchoredProbes, targetState):
     """
-    Updates state of the given probe in the target process
+    Updates state of the given probes in the target process, with a single bulk command
 
     :param app: Handle to an instance of the xpedite app
     :type app: xpedite.profiler.app.XpediteApp
-    :param anchoredProbe: The probe to activate/deactive
-    :type anchoredProbe: xpedite.types.probe.AnchoredProbe
-    :param targetState: Activation/deactivaatione flag for the given probe
+    :param anchoredProbes: A list of probes to activate/deactive
+    :param targetState: Activation/deactivaatione flag for the given probes
     :type targetState: bool
 
     """
-    probeFilePath = os.path.basename(anchoredProbe.filePath)
-    cmd = 'probes {} --file {} --line {}'.format(ProbeAdmin.targetStateStr(targetState),
-        probeFilePath, anchoredProbe.lineNo)
+    cmd = 'probes {}'.format(ProbeAdmin.targetStateStr(targetState))
+    for anchoredProbe in anchoredProbes:
+      probeFilePath = os.path.basename(anchoredProbe.filePath)
+      cmd += ' --file {} --line {}'.format(probeFilePath, anchoredProbe.lineNo)
     return app.admin(cmd, timeout=10)
 
   @staticmethod
@@ -68,8 +71,8 @@ class ProbeAdmin(object):
 
     """
 
-    for probe in anchoredProbes:
-      ProbeAdmin._updateProbe(app, probe, targetState)
+    if anchoredProbes:
+      ProbeAdmin._updateProbes(app, anchoredProbes, targetState)
 
     errCount = 0
     errMsg = ''
@@ -111,6 +114,45 @@ class ProbeAdmin(object):
     cmd = 'probes pmu  {} {}'.format(gpPmcOption, fixedPmcOption)
     return app.admin(cmd, timeout=10)
 
+  @staticmethod
+  def enableSampling(app, sampling):
+    """
+    Configures the target process to record a sample of transactions
+
+    :param app: an instance of xpedite app, to interact with target application
+    :param sampling: map with optional keys 'every' (record one in every N txns) and
+                     'rate' (max txns recorded per second, per thread)
+
+    """
+    cmd = 'probes sample'
+    if sampling.get('every'):
+      cmd += ' --every {}'.format(int(sampling['every']))
+    if sampling.get('rate'):
+      cmd += ' --rate {}'.format(int(sampling['rate']))
+    return app.admin(cmd, timeout=10)
+
+  @staticmethod
+  def enableCompactSamples(app, enable=True):
+    """
+    Configures the target process to record samples of probes without data, in a compact 8 byte format
+
+    :param app: an instance of xpedite app, to interact with target application
+    :param enable: flag to enable or disable compact samples
+
+    """
+    return app.admin('probes compact --enable {}'.format(1 if enable else 0), timeout=10)
+
+  @staticmethod
+  def enableTailFilter(app, thresholdNs):
+    """
+    Configures the target process to keep samples of transactions slower than a threshold
+
+    :param app: an instance of xpedite app, to interact with target application
+    :param thresholdNs: min latency of transactions kept, in nano seconds - 0 to disable the filter
+
+    """
+    return app.admin('probes tail --threshold {}'.format(int(thresholdNs)), timeout=10)
+
   @staticmethod
   def loadProbes(app):
     """
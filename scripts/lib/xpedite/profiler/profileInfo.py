@@ -18,7 +18,8 @@ class ProfileInfo(object):
   """Profile info stores settings and parameters to control profiling and report generation."""
 
   def __init__(self, appName, appHost, appInfo, probes, homeDir, pmc,
-    cpuSet, benchmarkPaths, classifier, resultOrder, txnFilter):
+    cpuSet, benchmarkPaths, classifier, resultOrder, txnFilter, sampling=None,
+    compactSamples=False, tailThreshold=None, polling=None):
     """
     Constructs an instance of ProfileInfo
 
@@ -34,6 +35,10 @@ class ProfileInfo(object):
     :param resultOrder: Default sort order for transactions in latency constituent reports
     :type resultOrder: xpedite.pmu.ResultOrder
     :param txnFilter: Lambda to filter transactions prior to report generation
+    :param sampling: Map to record a sample of transactions - keys 'every' and/or 'rate'
+    :param compactSamples: Flag to record samples of probes without data, in a compact 8 byte format
+    :param tailThreshold: Latency in nano seconds, to keep samples of slower transactions only
+    :param polling: Map to pace sample collection - keys 'policy' ('fixed' or 'adaptive'), 'watermark' and 'wakeup'
 
     """
     self.appName = appName.replace(' ', '_')
@@ -47,6 +52,10 @@ class ProfileInfo(object):
     self.classifier = classifier
     self.resultOrder = resultOrder
     self.txnFilter = txnFilter
+    self.sampling = sampling
+    self.compactSamples = compactSamples
+    self.tailThreshold = tailThreshold
+    self.polling = polling
 
   def __repr__(self):
     strRepr = 'app name = {}, appHost = {}, appInfo = {}\n'.format(self.appName, self.appHost, self.appInfo)
@@ -78,8 +87,13 @@ def loadProfileInfo(profilePath):
     resultOrder = getattr(profileInfo, 'resultOrder', None)
     homeDir = getattr(profileInfo, 'homeDir', None)
     txnFilter = getattr(profileInfo, 'txnFilter', None)
+    sampling = getattr(profileInfo, 'sampling', None)
+    compactSamples = getattr(profileInfo, 'compactSamples', False)
+    tailThreshold = getattr(profileInfo, 'tailThreshold', None)
+    polling = getattr(profileInfo, 'polling', None)
     return ProfileInfo(profileInfo.appName, profileInfo.appHost, profileInfo.appInfo,
-      profileInfo.probes, homeDir, pmc, cpuSet, benchmarkPaths, classifier, resultOrder, txnFilter)
+      profileInfo.probes, homeDir, pmc, cpuSet, benchmarkPaths, classifier, resultOrder, txnFilter, sampling,
+      compactSamples, tailThreshold, polling)
   except Exception:
     LOGGER.exception('failed to load profile file "%s"', profilePath)
     sys.exit(2)
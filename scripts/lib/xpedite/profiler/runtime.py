@@ -47,6 +47,9 @@ class AbstractRuntime(object):
     self.topdownCache = TopdownCache(self.eventsDbCache)
     self.topdownMetrics = None
     self.eventState = None
+    self.sampling = None
+    self.compactSamples = False
+    self.tailThreshold = None
 
   @staticmethod
   def formatProbes(probes):
@@ -77,6 +80,12 @@ class AbstractRuntime(object):
           msg = 'failed to enable PMU ({})'.format(errMsg)
           LOGGER.error(msg)
           raise Exception(msg)
+      if self.sampling:
+        LOGGER.info('Sampling transactions - %s', ProbeAdmin.enableSampling(self.app, self.sampling))
+      if self.compactSamples:
+        LOGGER.info('Compact samples - %s', ProbeAdmin.enableCompactSamples(self.app))
+      if self.tailThreshold:
+        LOGGER.info('Tail filter - %s', ProbeAdmin.enableTailFilter(self.app, self.tailThreshold))
       (errCount, errMsg) = ProbeAdmin.updateProbes(self.app, probes, targetState=True)
       if errCount > 0:
         msg = 'failed to enable probes ({} error(s))\n{}'.format(errCount, errMsg)
@@ -171,7 +180,8 @@ class AbstractRuntime(object):
 class Runtime(AbstractRuntime):
   """Xpedite suite runtime to orchestrate profile session"""
 
-  def __init__(self, app, probes, pmc=None, cpuSet=None, pollInterval=4, benchmarkProbes=None):
+  def __init__(self, app, probes, pmc=None, cpuSet=None, pollInterval=4, benchmarkProbes=None, sampling=None,
+    compactSamples=False, tailThreshold=None, polling=None):
     """
     Creates a new profiler runtime
 
@@ -193,6 +203,13 @@ class Runtime(AbstractRuntime):
     :type pollInterval: int
     :param benchmarkProbes: optional map to override probes used for benchmarks,
                             defaults to active probes of the current profile session
+    :param sampling: optional map to record a sample of transactions, with keys 'every'
+                     (one in every N txns) and/or 'rate' (max txns per second, per thread)
+    :param compactSamples: flag to record samples of probes without data, in a compact 8 byte format
+    :param tailThreshold: optional latency in nano seconds, to keep samples of slower transactions only
+    :param polling: optional map to pace sample collection, with keys 'policy' ('fixed' or 'adaptive'),
+                    'watermark' (buffers filled, to poll sooner) and 'wakeup' (flag to wake up the collector,
+                    on reaching the watermark)
     """
 
     from xpedite.dependencies     import Package, DEPENDENCY_LOADER
@@ -205,6 +222,9 @@ class Runtime(AbstractRuntime):
     try:
       AbstractRuntime.__init__(self, app, probes)
       self.benchmarkProbes = benchmarkProbes
+      self.sampling = sampling
+      self.compactSamples = compactSamples
+      self.tailThreshold = tailThreshold
       self.cpuInfo = app.getCpuInfo()
       eventsDb = self.eventsDbCache.get(self.cpuInfo.cpuId) if pmc else None
       if pmc:
@@ -216,7 +236,7 @@ class Runtime(AbstractRuntime):
           self.eventState = self.app.enablePMU(eventsDb, cpuSet, pmc)
         anchoredProbes = self.resolveProbes(probes)
         self.enableProbes(anchoredProbes)
-        self.app.beginProfile(pollInterval)
+        self.app.beginProfile(pollInterval, polling)
       else:
         if pmc:
           self.eventState = self.resolveEvents(eventsDb, cpuSet, pmc)
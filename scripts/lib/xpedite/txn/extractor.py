@@ -89,6 +89,7 @@ class Extractor(object):
             LOGGER.completed('\n\tprocessed %d counters | ', recordCount-1)
             iterBegin = time.time()
         recordCount += 1
+      self.loadLoss(threadId, loader, filePath)
       loader.endLoad()
       if inflateFd:
         inflateFd.close()
@@ -97,7 +98,7 @@ class Extractor(object):
       if self.orphanedRecords:
         LOGGER.warn('detected mismatch in binary vs app info - %d counters ignored', len(self.orphanedRecords))
       LOGGER.completed('%d records | %d txns loaded in %0.2f sec.', recordCount-1, loader.getCount(), elapsed)
-    if loader.isCompromised() or loader.getTxnCount() <= 0:
+    if loader.isCompromised() or loader.isLossy() or loader.getTxnCount() <= 0:
       LOGGER.warn(loader.report())
     elif loader.isNotAccounted():
       LOGGER.debug(loader.report())
@@ -109,6 +110,29 @@ class Extractor(object):
   INDEX_DATA = 2
   INDEX_PMC = 3
 
+  def loadLoss(self, threadId, loader, filePath):
+    """
+    Loads intervals, where samples of a thread were lost
+
+    :param threadId: Id of thread collecting the samples
+    :param loader: loader to build transactions out of the counters
+    :param filePath: Path to the samples file of the thread
+
+    """
+    extractor = subprocess.Popen([self.samplesLoader, '--losses', filePath],
+      stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
+    (output, errmsg) = extractor.communicate()
+    if extractor.returncode != 0:
+      raise Exception('failed to load losses from {} - {}'.format(filePath, errmsg))
+    droppedSampleCount = 0
+    records = output.splitlines()[1:]
+    for record in records:
+      fields = record.split(',')
+      loader.recordLoss(threadId, long(fields[0], 16), long(fields[1], 16), long(fields[2]), long(fields[3]))
+      droppedSampleCount += long(fields[3])
+    if records:
+      LOGGER.warn('thread %s lost %d samples in %d interval(s)', threadId, droppedSampleCount, len(records))
+
   def loadCounter(self, threadId, loader, probes, record):
     """
     Loads time and pmu counters from the given record
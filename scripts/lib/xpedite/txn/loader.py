@@ -46,6 +46,7 @@ class AbstractTxnLoader(object):
     self.compromisedTxns = []
     self.nonTxnCounters = []
     self.ephemeralCounters = []
+    self.lossyIntervals = []
     self.currentTxn = None
 
   def getTxnCount(self):
@@ -60,6 +61,25 @@ class AbstractTxnLoader(object):
     """Returns True, if any of the counters were skipped, due to data inconsistency"""
     return len(self.nonTxnCounters) > 0
 
+  def isLossy(self):
+    """Returns True, if samples were lost, while the collector lagged behind the target process"""
+    return len(self.lossyIntervals) > 0
+
+  def recordLoss(self, threadId, beginTsc, endTsc, overflowCount, droppedSampleCount):
+    """
+    Records an interval, where samples of a thread were lost
+
+    Transactions with counters in the interval [beginTsc, endTsc] may be incomplete
+
+    :param threadId: Id of thread, that lost the samples
+    :param beginTsc: Time stamp of the last sample collected before the loss (0, if none)
+    :param endTsc: Time stamp of the last sample collected, in the poll that detected the loss
+    :param overflowCount: Count of buffers overwritten
+    :param droppedSampleCount: Count of samples dropped
+
+    """
+    self.lossyIntervals.append((threadId, beginTsc, endTsc, overflowCount, droppedSampleCount))
+
   def appendTxn(self, txn):
     """
     Inserts or updates transaction to collection
@@ -81,6 +101,9 @@ class AbstractTxnLoader(object):
       report += ' and {:,} were accounted extraneous'.format(len(self.nonTxnCounters))
     else:
       report += '.'
+    if self.lossyIntervals:
+      report += ' {:,} samples were lost in {:,} interval(s).'.format(
+        sum(interval[4] for interval in self.lossyIntervals), len(self.lossyIntervals))
     return report
 
   def beginCollection(self, dataSources):
@@ -0,0 +1,89 @@
+"""
+Txn Table
+
+This module loads transactions built natively by xpediteSamplesLoader (--txns),
+from binary tables with a row per transaction and a row per stage.
+
+Columns of each table are memory mapped as numpy arrays, keyed by column name.
+Latency and pmc deltas are in tsc cycles. Call sites are stored as addresses and
+can be resolved to probes, using the probe map of the app info.
+
+Author: Manikandan Dhamodharan, Morgan Stanley
+"""
+
+import mmap
+import struct
+import subprocess
+import numpy
+from xpedite.txn.extractor import Extractor
+
+XPEDITE_TXN_TABLE_SIG = 0xC01DC01DC0DE7A85
+XPEDITE_TXN_TABLE_VERSION = 0x0100
+
+HEADER = struct.Struct('=9Q2I')
+COLUMN = struct.Struct('=24sIBBHQ')
+
+TXNS = 0
+STAGES = 1
+
+class TxnTable(object):
+  """Transactions and stages, loaded from a binary txn table"""
+
+  def __init__(self, path):
+    """
+    Loads the txn table at the given path
+
+    :param path: Path to the txn table
+
+    """
+    with open(path, 'rb') as fileHandle:
+      self.buffer = mmap.mmap(fileHandle.fileno(), 0, access=mmap.ACCESS_READ)
+    (signature, version, self.tscHz, self.txnCount, self.stageCount, self.compromisedTxnCount,
+      self.extraneousSampleCount, self.orphanedSampleCount, _, self.pmcCount, columnCount) = HEADER.unpack_from(self.buffer, 0)
+    if signature != XPEDITE_TXN_TABLE_SIG or version != XPEDITE_TXN_TABLE_VERSION:
+      raise Exception('detected invalid or incompatible txn table {}'.format(path))
+
+    self.txns = {}
+    self.stages = {}
+    for i in range(columnCount):
+      (name, width, table, isSigned, _, offset) = COLUMN.unpack_from(self.buffer, HEADER.size + i * COLUMN.size)
+      name = name.split(b'\0', 1)[0].decode()
+      dtype = numpy.dtype('{}{}'.format('i' if isSigned else 'u', width))
+      count = self.txnCount if table == TXNS else self.stageCount
+      column = numpy.frombuffer(self.buffer, dtype=dtype, count=count, offset=offset) if count else numpy.empty(0, dtype)
+      (self.txns if table == TXNS else self.stages)[name] = column
+
+  def stagesOf(self, txnIndex):
+    """
+    Returns a slice of the stage table, for the transaction at the given row
+
+    :param txnIndex: Row of the transaction in the txn table
+
+    """
+    begin = self.txns['FirstStage'][txnIndex]
+    end = begin + self.txns['StageCount'][txnIndex]
+    return dict((name, column[begin:end]) for name, column in self.stages.items())
+
+  def report(self):
+    """Returns statistics of the load"""
+    return 'loaded {:,} transactions ({:,} stages) | {:,} compromised | {:,} extraneous / {:,} orphaned counters'.format(
+      self.txnCount, self.stageCount, self.compromisedTxnCount, self.extraneousSampleCount, self.orphanedSampleCount)
+
+def buildTxnTable(samplesFiles, path, threadCount=None):
+  """
+  Builds transactions from the given samples files natively and loads them
+
+  :param samplesFiles: Samples files of all threads in the profile
+  :param path: Path to persist the txn table
+  :param threadCount: Count of threads to build transactions (Default value = all cores)
+
+  """
+  command = [Extractor.samplesLoader, '--txns', path]
+  if threadCount:
+    command.extend(['--threads', str(threadCount)])
+  command.extend(samplesFiles)
+  builder = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
+  (_, errmsg) = builder.communicate()
+  if builder.returncode != 0:
+    raise Exception('failed to build txns - {}'.format(errmsg))
+  return TxnTable(path)